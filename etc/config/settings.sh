@@ -352,6 +352,16 @@ then
 fi
 
 
+#
+# thrust headers for the host (Gcc) backend, THRUST_SYSTEM = OMP | TBB
+#
+case "$WM_COMPILER" in
+Gcc*)
+    : ${THRUST_ARCH_PATH:=/usr/local/cuda/include}; export THRUST_ARCH_PATH
+    : ${THRUST_SYSTEM:=OMP}; export THRUST_SYSTEM
+    ;;
+esac
+
 
 # Communications library
 # ~~~~~~~~~~~~~~~~~~~~~~